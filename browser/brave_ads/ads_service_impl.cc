@@ -885,7 +885,8 @@ void AdsServiceImpl::OnEnsureBaseDirectoryExists(const uint32_t number_of_start,
   }
 
   database_ = std::make_unique<ads::Database>(
-      base_path_.AppendASCII("database.sqlite"));
+      base_path_.AppendASCII("database.sqlite"),
+      base::FeatureList::IsEnabled(features::kTunedDatabase));
 
   bat_ads_service_->Create(
       bat_ads_client_receiver_.BindNewEndpointAndPassRemote(),
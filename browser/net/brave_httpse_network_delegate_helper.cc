@@ -54,7 +54,7 @@ int OnBeforeURLRequest_HttpsePreFileWork(
     std::shared_ptr<BraveRequestInfo> ctx) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
 
-  // Don't try to overwrite an already set URL by another delegate (adblock/tp)
+  // Don't try to overwrite an already set URL by another delegate (site hacks)
   if (!ctx->new_url_spec.empty()) {
     return net::OK;
   }
@@ -11,6 +11,7 @@
 #include "base/containers/contains.h"
 #include "base/feature_list.h"
 #include "base/task/post_task.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/browser/net/brave_ad_block_csp_network_delegate_helper.h"
 #include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
 #include "brave/browser/net/brave_common_static_redirect_network_delegate_helper.h"
@@ -66,34 +67,55 @@ BraveRequestHandler::BraveRequestHandler() {
 
 BraveRequestHandler::~BraveRequestHandler() = default;
 
-void BraveRequestHandler::SetupCallbacks() {
-  brave::OnBeforeURLRequestCallback callback =
-      base::BindRepeating(brave::OnBeforeURLRequest_SiteHacksWork);
-  before_url_request_callbacks_.push_back(callback);
+BraveRequestHandler::BeforeURLRequestHelper::BeforeURLRequestHelper(
+    const char* name,
+    brave::OnBeforeURLRequestCallback callback,
+    uint32_t reads,
+    uint32_t writes)
+    : name(name), callback(std::move(callback)), reads(reads), writes(writes) {}
 
-  callback = base::BindRepeating(brave::OnBeforeURLRequest_AdBlockTPPreWork);
-  before_url_request_callbacks_.push_back(callback);
+BraveRequestHandler::BeforeURLRequestHelper::BeforeURLRequestHelper(
+    const BeforeURLRequestHelper&) = default;
 
-  callback = base::BindRepeating(brave::OnBeforeURLRequest_HttpsePreFileWork);
-  before_url_request_callbacks_.push_back(callback);
+BraveRequestHandler::BeforeURLRequestHelper::~BeforeURLRequestHelper() =
+    default;
 
-  callback =
-      base::BindRepeating(brave::OnBeforeURLRequest_CommonStaticRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
+void BraveRequestHandler::SetupCallbacks() {
+  AddBeforeURLRequestHelper(
+      "SiteHacks",
+      base::BindRepeating(brave::OnBeforeURLRequest_SiteHacksWork));
+
+  // Ad blocking only looks at the request itself and HTTPS Everywhere only
+  // looks at the URL rewritten so far, so their lookups run at the same time.
+  AddBeforeURLRequestHelper(
+      "AdBlockTP",
+      base::BindRepeating(brave::OnBeforeURLRequest_AdBlockTPPreWork),
+      brave::kNoResult, brave::kBlockedByResult);
+  AddBeforeURLRequestHelper(
+      "HTTPSE",
+      base::BindRepeating(brave::OnBeforeURLRequest_HttpsePreFileWork),
+      brave::kNewURLSpecResult, brave::kNewURLSpecResult);
+
+  AddBeforeURLRequestHelper(
+      "CommonStaticRedirect",
+      base::BindRepeating(brave::OnBeforeURLRequest_CommonStaticRedirectWork));
 
 #if BUILDFLAG(DECENTRALIZED_DNS_ENABLED)
-  callback = base::BindRepeating(
-      decentralized_dns::OnBeforeURLRequest_DecentralizedDnsPreRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
+  AddBeforeURLRequestHelper(
+      "DecentralizedDns",
+      base::BindRepeating(
+          decentralized_dns::
+              OnBeforeURLRequest_DecentralizedDnsPreRedirectWork));
 #endif
 
-  callback = base::BindRepeating(brave_rewards::OnBeforeURLRequest);
-  before_url_request_callbacks_.push_back(callback);
+  AddBeforeURLRequestHelper(
+      "Rewards", base::BindRepeating(brave_rewards::OnBeforeURLRequest));
 
 #if BUILDFLAG(ENABLE_IPFS)
   if (base::FeatureList::IsEnabled(ipfs::features::kIpfsFeature)) {
-    callback = base::BindRepeating(ipfs::OnBeforeURLRequest_IPFSRedirectWork);
-    before_url_request_callbacks_.push_back(callback);
+    AddBeforeURLRequestHelper(
+        "IPFSRedirect",
+        base::BindRepeating(ipfs::OnBeforeURLRequest_IPFSRedirectWork));
     brave::OnHeadersReceivedCallback ipfs_headers_received_callback =
         base::BindRepeating(ipfs::OnHeadersReceived_IPFSRedirectWork);
     headers_received_callbacks_.push_back(ipfs_headers_received_callback);
@@ -132,6 +154,15 @@ void BraveRequestHandler::SetupCallbacks() {
   }
 }
 
+void BraveRequestHandler::AddBeforeURLRequestHelper(
+    const char* name,
+    brave::OnBeforeURLRequestCallback callback,
+    uint32_t reads,
+    uint32_t writes) {
+  before_url_request_helpers_.emplace_back(name, std::move(callback), reads,
+                                           writes);
+}
+
 bool BraveRequestHandler::IsRequestIdentifierValid(
     uint64_t request_identifier) {
   return base::Contains(callbacks_, request_identifier);
@@ -141,7 +172,7 @@ int BraveRequestHandler::OnBeforeURLRequest(
     std::shared_ptr<brave::BraveRequestInfo> ctx,
     net::CompletionOnceCallback callback,
     GURL* new_url) {
-  if (before_url_request_callbacks_.empty() || IsInternalScheme(ctx)) {
+  if (before_url_request_helpers_.empty() || IsInternalScheme(ctx)) {
     return net::OK;
   }
   ctx->new_url = new_url;
@@ -225,21 +256,13 @@ void BraveRequestHandler::RunNextCallback(
   int rv = net::OK;
 
   if (ctx->event_type == brave::kOnBeforeRequest) {
-    while (before_url_request_callbacks_.size() !=
-           ctx->next_url_request_index) {
-      brave::OnBeforeURLRequestCallback callback =
-          before_url_request_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::BindRepeating(&BraveRequestHandler::RunNextCallback,
-                              weak_factory_.GetWeakPtr(), ctx);
-      rv = callback.Run(next_callback, ctx);
-      if (rv == net::ERR_IO_PENDING) {
+    while (ctx->url_request_result == net::OK &&
+           before_url_request_helpers_.size() != ctx->next_url_request_index) {
+      if (!RunNextBeforeURLRequestHelpers(ctx)) {
         return;
       }
-      if (rv != net::OK) {
-        break;
-      }
     }
+    rv = ctx->url_request_result;
   } else if (ctx->event_type == brave::kOnBeforeStartTransaction) {
     while (before_start_transaction_callbacks_.size() !=
            ctx->next_url_request_index) {
@@ -297,3 +320,73 @@ void BraveRequestHandler::RunNextCallback(
   }
   RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
 }
+
+bool BraveRequestHandler::RunNextBeforeURLRequestHelpers(
+    std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK_EQ(ctx->pending_url_request_callbacks, 0u);
+
+  // Held while helpers are being started, so that a helper which finishes
+  // early can't move on to the next ones.
+  ctx->pending_url_request_callbacks++;
+
+  // Helpers join the batch as long as they don't read or write anything that
+  // the helpers already in it write, nor write anything those read. As
+  // helpers of a batch then write disjoint results, merging them doesn't
+  // depend on the order in which they finish.
+  const size_t first_index = ctx->next_url_request_index;
+  uint32_t batch_reads = brave::kNoResult;
+  uint32_t batch_writes = brave::kNoResult;
+  while (before_url_request_helpers_.size() != ctx->next_url_request_index) {
+    const size_t index = ctx->next_url_request_index;
+    const BeforeURLRequestHelper& helper = before_url_request_helpers_[index];
+    if (index != first_index &&
+        ((helper.reads & batch_writes) ||
+         (helper.writes & (batch_reads | batch_writes)))) {
+      break;
+    }
+    ctx->next_url_request_index++;
+    batch_reads |= helper.reads;
+    batch_writes |= helper.writes;
+
+    TRACE_EVENT_NESTABLE_ASYNC_BEGIN1(
+        "net", helper.name,
+        TRACE_ID_WITH_SCOPE(helper.name,
+                            TRACE_ID_LOCAL(ctx->request_identifier)),
+        "url", ctx->request_url.possibly_invalid_spec());
+    ctx->pending_url_request_callbacks++;
+    brave::ResponseCallback next_callback = base::BindRepeating(
+        &BraveRequestHandler::OnBeforeURLRequestHelperDone,
+        weak_factory_.GetWeakPtr(), ctx, index);
+    const int rv = helper.callback.Run(next_callback, ctx);
+    if (rv == net::ERR_IO_PENDING) {
+      continue;
+    }
+
+    OnBeforeURLRequestHelperDone(ctx, index);
+    // Helpers after the first failing one are never started, as before.
+    // Those already started are still waited for.
+    if (rv != net::OK) {
+      ctx->url_request_result = rv;
+      break;
+    }
+  }
+
+  return --ctx->pending_url_request_callbacks == 0;
+}
+
+void BraveRequestHandler::OnBeforeURLRequestHelperDone(
+    std::shared_ptr<brave::BraveRequestInfo> ctx,
+    size_t index) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK_GT(ctx->pending_url_request_callbacks, 0u);
+
+  const char* name = before_url_request_helpers_[index].name;
+  TRACE_EVENT_NESTABLE_ASYNC_END0(
+      "net", name,
+      TRACE_ID_WITH_SCOPE(name, TRACE_ID_LOCAL(ctx->request_identifier)));
+
+  if (--ctx->pending_url_request_callbacks == 0) {
+    RunNextCallback(ctx);
+  }
+}
@@ -46,10 +46,40 @@ class BraveRequestHandler {
   void RunCallbackForRequestIdentifier(uint64_t request_identifier, int rv);
 
  private:
+  // A before-URL-request helper along with the |brave::RequestInfoResult|s it
+  // reads and writes.
+  struct BeforeURLRequestHelper {
+    BeforeURLRequestHelper(const char* name,
+                           brave::OnBeforeURLRequestCallback callback,
+                           uint32_t reads,
+                           uint32_t writes);
+    BeforeURLRequestHelper(const BeforeURLRequestHelper&);
+    ~BeforeURLRequestHelper();
+
+    // Used as the trace event name, so it must be a string literal.
+    const char* name;
+    brave::OnBeforeURLRequestCallback callback;
+    uint32_t reads;
+    uint32_t writes;
+  };
+
+  friend class BraveRequestHandlerTest;
+
   void SetupCallbacks();
+  void AddBeforeURLRequestHelper(const char* name,
+                                 brave::OnBeforeURLRequestCallback callback,
+                                 uint32_t reads = brave::kAnyResult,
+                                 uint32_t writes = brave::kAnyResult);
   void RunNextCallback(std::shared_ptr<brave::BraveRequestInfo> ctx);
+  // Starts the next helpers which don't depend on each other, and returns
+  // whether all of them have finished already.
+  bool RunNextBeforeURLRequestHelpers(
+      std::shared_ptr<brave::BraveRequestInfo> ctx);
+  void OnBeforeURLRequestHelperDone(
+      std::shared_ptr<brave::BraveRequestInfo> ctx,
+      size_t index);
 
-  std::vector<brave::OnBeforeURLRequestCallback> before_url_request_callbacks_;
+  std::vector<BeforeURLRequestHelper> before_url_request_helpers_;
   std::vector<brave::OnBeforeStartTransactionCallback>
       before_start_transaction_callbacks_;
   std::vector<brave::OnHeadersReceivedCallback> headers_received_callbacks_;
@@ -0,0 +1,151 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_request_handler.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/test/bind.h"
+#include "brave/browser/net/url_context.h"
+#include "content/public/test/browser_task_environment.h"
+#include "net/base/net_errors.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "url/gurl.h"
+
+class BraveRequestHandlerTest : public testing::Test {
+ protected:
+  BraveRequestHandlerTest()
+      : handler_(std::make_unique<BraveRequestHandler>()) {
+    // Only the fake helpers added by the tests are run
+    handler_->before_url_request_helpers_.clear();
+  }
+
+  // Adds a helper which records that it was started and returns |rv|. When
+  // |rv| is |net::ERR_IO_PENDING| it finishes once |FinishHelper| is called.
+  void AddHelper(const std::string& name,
+                 int rv,
+                 uint32_t reads = brave::kAnyResult,
+                 uint32_t writes = brave::kAnyResult) {
+    handler_->AddBeforeURLRequestHelper(
+        "Test",
+        base::BindLambdaForTesting(
+            [this, name, rv](const brave::ResponseCallback& next_callback,
+                             std::shared_ptr<brave::BraveRequestInfo> ctx) {
+              started_helpers_.push_back(name);
+              if (rv == net::ERR_IO_PENDING) {
+                pending_helpers_[name] = next_callback;
+              }
+              return rv;
+            }),
+        reads, writes);
+  }
+
+  void FinishHelper(const std::string& name) {
+    auto iter = pending_helpers_.find(name);
+    ASSERT_NE(iter, pending_helpers_.end());
+    brave::ResponseCallback next_callback = iter->second;
+    pending_helpers_.erase(iter);
+    next_callback.Run();
+    task_environment_.RunUntilIdle();
+  }
+
+  int StartRequest() {
+    ctx_ = std::make_shared<brave::BraveRequestInfo>(
+        GURL("https://brave.com/"));
+    ctx_->request_identifier = 1;
+    const int rv = handler_->OnBeforeURLRequest(
+        ctx_, base::BindLambdaForTesting([this](int rv) { result_ = rv; }),
+        &new_url_);
+    task_environment_.RunUntilIdle();
+    return rv;
+  }
+
+  void DestroyRequest() { handler_->OnURLRequestDestroyed(ctx_); }
+
+  content::BrowserTaskEnvironment task_environment_;
+  std::unique_ptr<BraveRequestHandler> handler_;
+  std::shared_ptr<brave::BraveRequestInfo> ctx_;
+  GURL new_url_;
+  absl::optional<int> result_;
+  std::vector<std::string> started_helpers_;
+  std::map<std::string, brave::ResponseCallback> pending_helpers_;
+};
+
+TEST_F(BraveRequestHandlerTest, PendingHelpersOfABatchFinishInOrder) {
+  AddHelper("a", net::ERR_IO_PENDING, brave::kNoResult,
+            brave::kBlockedByResult);
+  AddHelper("b", net::ERR_IO_PENDING, brave::kNoResult,
+            brave::kNewURLSpecResult);
+  AddHelper("c", net::OK);
+
+  EXPECT_EQ(StartRequest(), net::ERR_IO_PENDING);
+  EXPECT_EQ(started_helpers_, (std::vector<std::string>{"a", "b"}));
+
+  FinishHelper("a");
+  EXPECT_EQ(started_helpers_, (std::vector<std::string>{"a", "b"}));
+  EXPECT_FALSE(result_);
+
+  FinishHelper("b");
+  EXPECT_EQ(started_helpers_, (std::vector<std::string>{"a", "b", "c"}));
+  EXPECT_EQ(result_, net::OK);
+}
+
+TEST_F(BraveRequestHandlerTest, PendingHelpersOfABatchFinishInReverseOrder) {
+  AddHelper("a", net::ERR_IO_PENDING, brave::kNoResult,
+            brave::kBlockedByResult);
+  AddHelper("b", net::ERR_IO_PENDING, brave::kNoResult,
+            brave::kNewURLSpecResult);
+  AddHelper("c", net::OK);
+
+  EXPECT_EQ(StartRequest(), net::ERR_IO_PENDING);
+  EXPECT_EQ(started_helpers_, (std::vector<std::string>{"a", "b"}));
+
+  FinishHelper("b");
+  EXPECT_EQ(started_helpers_, (std::vector<std::string>{"a", "b"}));
+  EXPECT_FALSE(result_);
+
+  FinishHelper("a");
+  EXPECT_EQ(started_helpers_, (std::vector<std::string>{"a", "b", "c"}));
+  EXPECT_EQ(result_, net::OK);
+}
+
+TEST_F(BraveRequestHandlerTest, SynchronousErrorWaitsForPendingBatchPeer) {
+  AddHelper("a", net::ERR_IO_PENDING, brave::kNoResult,
+            brave::kBlockedByResult);
+  AddHelper("b", net::ERR_FAILED, brave::kNoResult, brave::kNewURLSpecResult);
+  AddHelper("c", net::OK);
+
+  EXPECT_EQ(StartRequest(), net::ERR_IO_PENDING);
+  EXPECT_EQ(started_helpers_, (std::vector<std::string>{"a", "b"}));
+  EXPECT_FALSE(result_);
+
+  // The error is reported once the peer finishes, and later helpers are
+  // never started
+  FinishHelper("a");
+  EXPECT_EQ(started_helpers_, (std::vector<std::string>{"a", "b"}));
+  EXPECT_EQ(result_, net::ERR_FAILED);
+}
+
+TEST_F(BraveRequestHandlerTest, RequestDestroyedWhileHelpersPending) {
+  AddHelper("a", net::ERR_IO_PENDING, brave::kNoResult,
+            brave::kBlockedByResult);
+  AddHelper("b", net::ERR_IO_PENDING, brave::kNoResult,
+            brave::kNewURLSpecResult);
+  AddHelper("c", net::OK);
+
+  EXPECT_EQ(StartRequest(), net::ERR_IO_PENDING);
+  FinishHelper("a");
+
+  DestroyRequest();
+  FinishHelper("b");
+
+  EXPECT_EQ(started_helpers_, (std::vector<std::string>{"a", "b"}));
+  EXPECT_FALSE(result_);
+  EXPECT_FALSE(handler_->IsRequestIdentifierValid(ctx_->request_identifier));
+}
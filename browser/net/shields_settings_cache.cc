@@ -0,0 +1,101 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/shields_settings_cache.h"
+
+#include <memory>
+
+#include "base/memory/ptr_util.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/browser/profiles/profile.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "content/public/browser/browser_context.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace brave {
+
+namespace {
+
+// User data key for ShieldsSettingsCache.
+const void* const kShieldsSettingsCacheUserDataKey =
+    &kShieldsSettingsCacheUserDataKey;
+
+// Tab origins are few compared to their requests, so the cache is simply
+// dropped rather than evicted entry by entry once it grows this large.
+constexpr size_t kMaxSnapshots = 128;
+
+}  // namespace
+
+ShieldsSettingsCache::ShieldsSettingsCache(
+    content::BrowserContext* browser_context)
+    : map_(HostContentSettingsMapFactory::GetForProfile(
+          Profile::FromBrowserContext(browser_context))) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK(map_);
+
+  map_->AddObserver(this);
+}
+
+ShieldsSettingsCache::~ShieldsSettingsCache() {
+  map_->RemoveObserver(this);
+}
+
+// static
+ShieldsSettingsCache* ShieldsSettingsCache::FromBrowserContext(
+    content::BrowserContext* browser_context) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  auto* self = static_cast<ShieldsSettingsCache*>(
+      browser_context->GetUserData(kShieldsSettingsCacheUserDataKey));
+  if (!self) {
+    self = new ShieldsSettingsCache(browser_context);
+    browser_context->SetUserData(kShieldsSettingsCacheUserDataKey,
+                                 base::WrapUnique(self));
+  }
+
+  return self;
+}
+
+ShieldsSettingsSnapshot ShieldsSettingsCache::Get(const GURL& tab_origin) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  auto iter = snapshots_.find(tab_origin);
+  if (iter != snapshots_.end()) {
+    return iter->second;
+  }
+
+  if (snapshots_.size() >= kMaxSnapshots) {
+    snapshots_.clear();
+  }
+
+  HostContentSettingsMap* map = map_.get();
+
+  ShieldsSettingsSnapshot snapshot;
+  snapshot.allow_brave_shields =
+      brave_shields::GetBraveShieldsEnabled(map, tab_origin);
+  snapshot.allow_ads = brave_shields::GetAdControlType(map, tab_origin) ==
+                       brave_shields::ControlType::ALLOW;
+  // Currently, "aggressive" mode is registered as a cosmetic filtering control
+  // type, even though it can also affect network blocking.
+  snapshot.aggressive_blocking =
+      brave_shields::GetCosmeticFilteringControlType(map, tab_origin) ==
+      brave_shields::ControlType::BLOCK;
+  snapshot.allow_http_upgradable_resource =
+      !brave_shields::GetHTTPSEverywhereEnabled(map, tab_origin);
+  snapshot.allow_referrers = brave_shields::AllowReferrers(map, tab_origin);
+
+  snapshots_.emplace(tab_origin, snapshot);
+  return snapshot;
+}
+
+void ShieldsSettingsCache::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsTypeSet content_type_set) {
+  snapshots_.clear();
+}
+
+}  // namespace brave
@@ -0,0 +1,69 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_SHIELDS_SETTINGS_CACHE_H_
+#define BRAVE_BROWSER_NET_SHIELDS_SETTINGS_CACHE_H_
+
+#include <cstddef>
+#include <map>
+
+#include "base/memory/scoped_refptr.h"
+#include "base/supports_user_data.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
+#include "url/gurl.h"
+
+class HostContentSettingsMap;
+
+namespace content {
+class BrowserContext;
+}
+
+namespace brave {
+
+// The shields flags of a tab origin which |BraveRequestInfo| needs for every
+// request made by that tab.
+struct ShieldsSettingsSnapshot {
+  bool allow_brave_shields = true;
+  bool allow_ads = false;
+  bool aggressive_blocking = false;
+  bool allow_http_upgradable_resource = false;
+  bool allow_referrers = false;
+};
+
+// Caches |ShieldsSettingsSnapshot|s by tab origin, so the content settings of
+// a page are looked up once rather than for each of its subresources. There is
+// one |ShieldsSettingsCache| per profile, and it is cleared whenever a content
+// setting changes.
+class ShieldsSettingsCache : public base::SupportsUserData::Data,
+                             public content_settings::Observer {
+ public:
+  ShieldsSettingsCache(const ShieldsSettingsCache&) = delete;
+  ShieldsSettingsCache& operator=(const ShieldsSettingsCache&) = delete;
+  ~ShieldsSettingsCache() override;
+
+  static ShieldsSettingsCache* FromBrowserContext(
+      content::BrowserContext* browser_context);
+
+  // Returns a copy, since a later |Get| or content setting change may drop the
+  // cached snapshot.
+  ShieldsSettingsSnapshot Get(const GURL& tab_origin);
+
+  size_t GetSizeForTesting() const { return snapshots_.size(); }
+
+ private:
+  explicit ShieldsSettingsCache(content::BrowserContext* browser_context);
+
+  // content_settings::Observer:
+  void OnContentSettingChanged(const ContentSettingsPattern& primary_pattern,
+                               const ContentSettingsPattern& secondary_pattern,
+                               ContentSettingsTypeSet content_type_set) override;
+
+  scoped_refptr<HostContentSettingsMap> map_;
+  std::map<GURL, ShieldsSettingsSnapshot> snapshots_;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_SHIELDS_SETTINGS_CACHE_H_
@@ -0,0 +1,71 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/shields_settings_cache.h"
+
+#include "base/strings/stringprintf.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/test/base/testing_profile.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+class ShieldsSettingsCacheTest : public testing::Test {
+ protected:
+  ShieldsSettingsCache* cache() {
+    return ShieldsSettingsCache::FromBrowserContext(&profile_);
+  }
+
+  HostContentSettingsMap* map() {
+    return HostContentSettingsMapFactory::GetForProfile(&profile_);
+  }
+
+ private:
+  content::BrowserTaskEnvironment task_environment_;
+  TestingProfile profile_;
+};
+
+TEST_F(ShieldsSettingsCacheTest, SnapshotIsCached) {
+  const GURL tab_origin("https://brave.com/");
+
+  EXPECT_TRUE(cache()->Get(tab_origin).allow_brave_shields);
+  EXPECT_TRUE(cache()->Get(tab_origin).allow_brave_shields);
+  EXPECT_EQ(cache()->GetSizeForTesting(), 1u);
+}
+
+TEST_F(ShieldsSettingsCacheTest, ContentSettingChangeInvalidatesSnapshots) {
+  const GURL tab_origin("https://brave.com/");
+  const ShieldsSettingsSnapshot snapshot = cache()->Get(tab_origin);
+  EXPECT_TRUE(snapshot.allow_brave_shields);
+
+  brave_shields::SetBraveShieldsEnabled(map(), false, tab_origin);
+  EXPECT_EQ(cache()->GetSizeForTesting(), 0u);
+
+  EXPECT_FALSE(cache()->Get(tab_origin).allow_brave_shields);
+  // A snapshot taken before the change keeps its values
+  EXPECT_TRUE(snapshot.allow_brave_shields);
+}
+
+TEST_F(ShieldsSettingsCacheTest, CacheIsDroppedOnceFull) {
+  for (int i = 0; i < 128; i++) {
+    cache()->Get(GURL(base::StringPrintf("https://%d.brave.com/", i)));
+  }
+  EXPECT_EQ(cache()->GetSizeForTesting(), 128u);
+
+  // Looking up a cached origin doesn't evict anything
+  cache()->Get(GURL("https://0.brave.com/"));
+  EXPECT_EQ(cache()->GetSizeForTesting(), 128u);
+
+  const ShieldsSettingsSnapshot snapshot =
+      cache()->Get(GURL("https://128.brave.com/"));
+  EXPECT_EQ(cache()->GetSizeForTesting(), 1u);
+  EXPECT_TRUE(snapshot.allow_brave_shields);
+}
+
+}  // namespace brave
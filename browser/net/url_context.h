@@ -10,10 +10,12 @@
 #include <set>
 #include <string>
 
+#include "net/base/net_errors.h"
 #include "net/base/network_isolation_key.h"
 #include "net/http/http_request_headers.h"
 #include "net/http/http_response_headers.h"
 #include "net/url_request/referrer_policy.h"
+#include "services/network/public/cpp/resource_request_body.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
 #include "url/gurl.h"
@@ -51,6 +53,19 @@ enum BraveNetworkDelegateEventType {
 
 enum BlockedBy { kNotBlocked, kAdBlocked, kOtherBlocked };
 
+// The parts of |BraveRequestInfo| which |OnBeforeURLRequestCallback|s produce
+// for each other. Helpers declare which of them they read and write, so that
+// |BraveRequestHandler| can run helpers which don't depend on each other at the
+// same time.
+enum RequestInfoResult : uint32_t {
+  kNoResult = 0,
+  // |new_url_spec|.
+  kNewURLSpecResult = 1 << 0,
+  // |blocked_by| and |mock_data_url|.
+  kBlockedByResult = 1 << 1,
+  kAnyResult = ~0u,
+};
+
 struct BraveRequestInfo {
   BraveRequestInfo();
   BraveRequestInfo(const BraveRequestInfo&) = delete;
@@ -118,7 +133,13 @@ struct BraveRequestInfo {
       static_cast<blink::mojom::ResourceType>(-1);
   blink::mojom::ResourceType resource_type = kInvalidResourceType;
 
-  std::string upload_data;
+  // Shares the body of the request rather than copying it, see
+  // |GetUploadData|.
+  scoped_refptr<network::ResourceRequestBody> request_body;
+
+  // Concatenates the in-memory bytes of |request_body|. This copies the body,
+  // so it should only be called once a helper knows it needs it.
+  std::string GetUploadData() const;
 
   static std::shared_ptr<brave::BraveRequestInfo> MakeCTX(
       const network::ResourceRequest& request,
@@ -134,6 +155,10 @@ struct BraveRequestInfo {
   friend class ::BraveRequestHandler;
 
   GURL* new_url = nullptr;
+  // Before-URL-request helpers which were started but haven't finished yet.
+  size_t pending_url_request_callbacks = 0;
+  // The first error returned by a before-URL-request helper.
+  int url_request_result = net::OK;
 };
 
 // ResponseListener
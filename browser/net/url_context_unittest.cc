@@ -0,0 +1,37 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_context.h"
+
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/time/time.h"
+#include "services/network/public/cpp/resource_request_body.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+TEST(BraveRequestInfoTest, NoUploadData) {
+  brave::BraveRequestInfo request_info(GURL("https://brave.com/"));
+  EXPECT_EQ(request_info.GetUploadData(), "");
+}
+
+TEST(BraveRequestInfoTest, UploadDataSkipsNonBytesElements) {
+  auto body = base::MakeRefCounted<network::ResourceRequestBody>();
+  const std::string first = "query=";
+  const std::string second = "brave";
+  body->AppendBytes(first.data(), first.size());
+  body->AppendFileRange(base::FilePath(FILE_PATH_LITERAL("upload.bin")), 0,
+                        1024, base::Time());
+  body->AppendBytes(second.data(), second.size());
+
+  brave::BraveRequestInfo request_info(GURL("https://brave.com/"));
+  request_info.request_body = body;
+
+  // The body is shared rather than copied until it is asked for
+  EXPECT_EQ(request_info.request_body.get(), body.get());
+  EXPECT_EQ(request_info.GetUploadData(), "query=brave");
+}
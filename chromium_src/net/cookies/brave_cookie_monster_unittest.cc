@@ -0,0 +1,78 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "net/cookies/cookie_monster.h"
+
+#include <memory>
+#include <string>
+
+#include "base/test/task_environment.h"
+#include "base/time/time.h"
+#include "net/cookies/canonical_cookie.h"
+#include "net/cookies/cookie_deletion_info.h"
+#include "net/cookies/cookie_options.h"
+#include "net/cookies/cookie_partition_key_collection.h"
+#include "net/cookies/cookie_store_test_callbacks.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+#include "url/origin.h"
+
+namespace net {
+
+class BraveCookieMonsterTest : public testing::Test {
+ protected:
+  static CookieOptions MakeEphemeralOptions(const std::string& top_frame) {
+    CookieOptions options = CookieOptions::MakeAllInclusive();
+    options.set_should_use_ephemeral_storage(true);
+    options.set_top_frame_origin(url::Origin::Create(GURL(top_frame)));
+    return options;
+  }
+
+  bool SetCookie(const GURL& url,
+                 const std::string& cookie_line,
+                 const CookieOptions& options) {
+    ResultSavingCookieCallback<CookieAccessResult> callback;
+    cookie_monster_.SetCanonicalCookieAsync(
+        CanonicalCookie::Create(url, cookie_line, base::Time::Now(),
+                                /*server_time=*/absl::nullopt,
+                                /*cookie_partition_key=*/absl::nullopt),
+        url, options, callback.MakeCallback());
+    callback.WaitUntilDone();
+    return callback.result().status.IsInclude();
+  }
+
+  size_t CountCookies(const GURL& url, const CookieOptions& options) {
+    GetCookieListCallback callback;
+    cookie_monster_.GetCookieListWithOptionsAsync(
+        url, options, CookiePartitionKeyCollection(), callback.MakeCallback());
+    callback.WaitUntilDone();
+    return callback.cookies().size();
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  CookieMonster cookie_monster_{nullptr /* store */, nullptr /* net_log */,
+                                /*first_party_sets_enabled=*/false};
+};
+
+TEST_F(BraveCookieMonsterTest, EphemeralCookiesArePartitionedByTopFrame) {
+  const GURL url("https://embedded.com/");
+  EXPECT_EQ(CountCookies(url, MakeEphemeralOptions("https://a.com")), 0u);
+
+  ASSERT_TRUE(
+      SetCookie(url, "name=value", MakeEphemeralOptions("https://a.com")));
+  EXPECT_EQ(CountCookies(url, MakeEphemeralOptions("https://a.com")), 1u);
+  EXPECT_EQ(CountCookies(url, MakeEphemeralOptions("https://b.com")), 0u);
+  EXPECT_EQ(CountCookies(url, CookieOptions::MakeAllInclusive()), 0u);
+
+  CookieDeletionInfo delete_info;
+  delete_info.ephemeral_storage_domain = "a.com";
+  ResultSavingCookieCallback<uint32_t> delete_callback;
+  cookie_monster_.DeleteAllMatchingInfoAsync(std::move(delete_info),
+                                             delete_callback.MakeCallback());
+  delete_callback.WaitUntilDone();
+  EXPECT_EQ(CountCookies(url, MakeEphemeralOptions("https://a.com")), 0u);
+}
+
+}  // namespace net
@@ -34,6 +34,13 @@ CookieMonster::CookieMonster(scoped_refptr<PersistentCookieStore> store,
 
 CookieMonster::~CookieMonster() {}
 
+ChromiumCookieMonster* CookieMonster::GetEphemeralCookieStoreForTopFrameURL(
+    const GURL& top_frame_url) {
+  auto it =
+      ephemeral_cookie_stores_.find(URLToEphemeralStorageDomain(top_frame_url));
+  return it != ephemeral_cookie_stores_.end() ? it->second.get() : nullptr;
+}
+
 ChromiumCookieMonster*
 CookieMonster::GetOrCreateEphemeralCookieStoreForTopFrameURL(
     const GURL& top_frame_url) {
@@ -144,8 +151,13 @@ void CookieMonster::GetCookieListWithOptionsAsync(
       return;
     }
     ChromiumCookieMonster* ephemeral_monster =
-        GetOrCreateEphemeralCookieStoreForTopFrameURL(
+        GetEphemeralCookieStoreForTopFrameURL(
             options.top_frame_origin()->GetURL());
+    if (!ephemeral_monster) {
+      MaybeRunCookieCallback(std::move(callback), CookieAccessResultList(),
+                             CookieAccessResultList());
+      return;
+    }
     ephemeral_monster->GetCookieListWithOptionsAsync(
         url, options, cookie_partition_key_collection, std::move(callback));
     return;
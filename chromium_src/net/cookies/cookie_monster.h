@@ -57,6 +57,11 @@ class NET_EXPORT CookieMonster : public ChromiumCookieMonster {
   NetLogWithSource net_log_;
   std::map<std::string, std::unique_ptr<ChromiumCookieMonster>>
       ephemeral_cookie_stores_;
+  // Reading cookies doesn't need a store, so only writes create one. This
+  // keeps sites that are embedded but never set a cookie from allocating a
+  // monster per top-frame domain.
+  ChromiumCookieMonster* GetEphemeralCookieStoreForTopFrameURL(
+      const GURL& top_frame_url);
   ChromiumCookieMonster* GetOrCreateEphemeralCookieStoreForTopFrameURL(
       const GURL& top_frame_url);
 };
@@ -28,6 +28,9 @@ const base::Feature kSupportBraveSearchResultAdConfirmationEvents{
     "SupportBraveSearchResultAdConfirmationEvents",
     base::FEATURE_DISABLED_BY_DEFAULT};
 
+const base::Feature kTunedDatabase{"AdsTunedDatabase",
+                                   base::FEATURE_DISABLED_BY_DEFAULT};
+
 namespace {
 
 // Set to true to support multiple displays or false to only support the primary
@@ -44,6 +44,8 @@ bool IsRequestAdsEnabledApiEnabled();
 
 extern const base::Feature kSupportBraveSearchResultAdConfirmationEvents;
 
+extern const base::Feature kTunedDatabase;
+
 }  // namespace features
 }  // namespace brave_ads
 
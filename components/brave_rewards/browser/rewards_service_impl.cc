@@ -464,7 +464,9 @@ void RewardsServiceImpl::StartLedgerProcessIfNecessary() {
   }
 
   ledger_database_.reset(
-      ledger::LedgerDatabase::CreateInstance(publisher_info_db_path_));
+      base::FeatureList::IsEnabled(features::kTunedDatabaseFeature)
+          ? ledger::LedgerDatabase::CreateTunedInstance(publisher_info_db_path_)
+          : ledger::LedgerDatabase::CreateInstance(publisher_info_db_path_));
 
   BLOG(1, "Starting ledger process");
 
@@ -743,6 +745,12 @@ void RewardsServiceImpl::OnPostData(SessionID tab_id,
     return;
   }
 
+  if (!ledger::Ledger::ShouldProcessMediaLink(url.spec(),
+                                              first_party_url.spec(),
+                                              referrer.spec())) {
+    return;
+  }
+
   std::string output;
   url::RawCanonOutputW<1024> canonOutput;
   url::DecodeURLEscapeSequences(post_data.c_str(),
@@ -778,6 +786,14 @@ void RewardsServiceImpl::OnXHRLoad(SessionID tab_id,
     return;
   }
 
+  // Drop loads the ledger does not process before parsing the query and
+  // sending it over
+  if (!ledger::Ledger::ShouldProcessMediaLink(url.spec(),
+                                              first_party_url.spec(),
+                                              referrer.spec())) {
+    return;
+  }
+
   base::flat_map<std::string, std::string> parts;
 
   for (net::QueryIterator it(url); !it.IsAtEnd(); it.Advance()) {
@@ -1418,7 +1434,9 @@ void RewardsServiceImpl::StopLedger(StopLedgerCallback callback) {
     return;
   }
 
-  bat_ledger_->Shutdown(base::BindOnce(
+  // Visits not saved yet would only be written to a database that is about to
+  // be deleted
+  bat_ledger_->Shutdown(resetting_rewards_, base::BindOnce(
       &RewardsServiceImpl::OnStopLedger,
       AsWeakPtr(),
       std::move(callback)));
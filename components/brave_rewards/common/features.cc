@@ -18,5 +18,8 @@ const base::Feature kGeminiFeature{"BraveRewardsGemini",
 const base::Feature kVerboseLoggingFeature{"BraveRewardsVerboseLogging",
                                            base::FEATURE_DISABLED_BY_DEFAULT};
 
+const base::Feature kTunedDatabaseFeature{"BraveRewardsTunedDatabase",
+                                          base::FEATURE_DISABLED_BY_DEFAULT};
+
 }  // namespace features
 }  // namespace brave_rewards
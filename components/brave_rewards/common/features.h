@@ -21,6 +21,8 @@ extern const base::Feature kGeminiFeature;
 
 extern const base::Feature kVerboseLoggingFeature;
 
+extern const base::Feature kTunedDatabaseFeature;
+
 }  // namespace features
 }  // namespace brave_rewards
 
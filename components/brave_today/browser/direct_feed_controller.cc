@@ -28,6 +28,7 @@
 #include "brave/components/brave_today/rust/lib.rs.h"
 #include "components/prefs/pref_service.h"
 #include "net/base/load_flags.h"
+#include "net/http/http_status_code.h"
 #include "net/http/http_request_headers.h"
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
@@ -40,6 +41,11 @@ namespace brave_news {
 
 namespace {
 
+// Feeds larger than this are not downloaded, as the whole body is held in
+// memory to be parsed.
+constexpr size_t kMaxFeedBodySize = 5 * 1024 * 1024;
+constexpr base::TimeDelta kDownloadTimeout = base::Seconds(30);
+
 mojom::ArticlePtr RustFeedItemToArticle(const FeedItem& rust_feed_item) {
   // We don't include description since there does not exist a
   // UI which uses that field at the moment.
@@ -236,6 +242,18 @@ void DirectFeedController::DownloadAllContent(
   auto feed_content_handler = base::BarrierCallback<Articles>(
       publishers.size(), std::move(all_done_handler));
   base::flat_set<GURL> direct_feed_urls;
+  for (auto& publisher : publishers) {
+    direct_feed_urls.insert(publisher->feed_source);
+  }
+  // Forget feeds which are no longer subscribed to, including any that were
+  // only downloaded to be verified.
+  for (auto it = feed_cache_.begin(); it != feed_cache_.end();) {
+    if (direct_feed_urls.contains(it->first)) {
+      ++it;
+    } else {
+      it = feed_cache_.erase(it);
+    }
+  }
   for (auto& publisher : publishers) {
     VLOG(1) << "Downloading feed content from "
             << publisher->feed_source.spec();
@@ -291,25 +309,65 @@ void DirectFeedController::DownloadFeedContent(const GURL& feed_url,
 
 void DirectFeedController::DownloadFeed(const GURL& feed_url,
                                         DownloadFeedCallback callback) {
+  pending_downloads_.push_back({feed_url, std::move(callback)});
+  StartPendingDownloads();
+}
+
+void DirectFeedController::StartPendingDownloads() {
+  // Start downloads in the order they were asked for, skipping over those
+  // whose host already has its share in flight.
+  auto it = pending_downloads_.begin();
+  while (it != pending_downloads_.end() &&
+         active_downloads_ < kMaxConcurrentDirectFeedDownloads) {
+    auto host_downloads = downloads_per_host_.find(it->feed_url.host());
+    if (host_downloads != downloads_per_host_.end() &&
+        host_downloads->second >= kMaxConcurrentDirectFeedDownloadsPerHost) {
+      ++it;
+      continue;
+    }
+    PendingDownload download = std::move(*it);
+    it = pending_downloads_.erase(it);
+    StartDownload(download.feed_url, std::move(download.callback));
+  }
+}
+
+void DirectFeedController::StartDownload(const GURL& feed_url,
+                                         DownloadFeedCallback callback) {
+  active_downloads_++;
+  downloads_per_host_[feed_url.host()]++;
   // Make request
   auto request = std::make_unique<network::ResourceRequest>();
   request->url = feed_url;
   request->load_flags = net::LOAD_DO_NOT_SAVE_COOKIES;
   request->credentials_mode = network::mojom::CredentialsMode::kOmit;
   request->method = net::HttpRequestHeaders::kGetMethod;
+  // Ask for the body only if the feed changed since it was last downloaded.
+  auto cached_feed = feed_cache_.find(feed_url);
+  if (cached_feed != feed_cache_.end()) {
+    if (!cached_feed->second.etag.empty()) {
+      request->headers.SetHeader(net::HttpRequestHeaders::kIfNoneMatch,
+                                 cached_feed->second.etag);
+    }
+    if (!cached_feed->second.last_modified.empty()) {
+      request->headers.SetHeader(net::HttpRequestHeaders::kIfModifiedSince,
+                                 cached_feed->second.last_modified);
+    }
+  }
   auto url_loader = network::SimpleURLLoader::Create(
       std::move(request), GetNetworkTrafficAnnotationTag());
   url_loader->SetRetryOptions(
       1, network::SimpleURLLoader::RetryMode::RETRY_ON_5XX |
              network::SimpleURLLoader::RetryMode::RETRY_ON_NETWORK_CHANGE);
   url_loader->SetAllowHttpErrorResults(true);
+  // Don't let a stalled server hold a download slot
+  url_loader->SetTimeoutDuration(kDownloadTimeout);
   auto iter = url_loaders_.insert(url_loaders_.begin(), std::move(url_loader));
   iter->get()->DownloadToString(
       url_loader_factory_.get(),
       // Handle response
       base::BindOnce(&DirectFeedController::OnResponse, base::Unretained(this),
                      iter, std::move(callback), feed_url),
-      5 * 1024 * 1024);
+      kMaxFeedBodySize);
 }
 
 void DirectFeedController::OnResponse(
@@ -320,19 +378,43 @@ void DirectFeedController::OnResponse(
   // Parse response data
   auto* loader = iter->get();
   auto response_code = -1;
-  base::flat_map<std::string, std::string> headers;
+  std::string etag;
+  std::string last_modified;
   if (loader->ResponseInfo()) {
     auto headers_list = loader->ResponseInfo()->headers;
     if (headers_list) {
       response_code = headers_list->response_code();
+      headers_list->GetNormalizedHeader("etag", &etag);
+      headers_list->GetNormalizedHeader("last-modified", &last_modified);
     }
   }
   url_loaders_.erase(iter);
+  DCHECK_GT(active_downloads_, 0u);
+  active_downloads_--;
+  auto host_downloads = downloads_per_host_.find(feed_url.host());
+  if (host_downloads != downloads_per_host_.end() &&
+      --host_downloads->second == 0) {
+    downloads_per_host_.erase(host_downloads);
+  }
+  StartPendingDownloads();
+  auto result = std::make_unique<DirectFeedResponse>(DirectFeedResponse());
+  result->url = feed_url;
+  // Feed is unchanged since the cached download
+  auto cached_feed = feed_cache_.find(feed_url);
+  if (response_code == net::HTTP_NOT_MODIFIED &&
+      cached_feed != feed_cache_.end()) {
+    VLOG(1) << feed_url.spec() << " not modified.";
+    result->success = true;
+    result->data = cached_feed->second.data;
+    std::move(callback).Run(std::move(result));
+    return;
+  }
+  if (cached_feed != feed_cache_.end()) {
+    feed_cache_.erase(cached_feed);
+  }
   // Validate if we get a feed
   std::string body_content = response_body ? *response_body : "";
   // TODO(petemill): handle any url redirects and change the stored feed url?
-  auto result = std::make_unique<DirectFeedResponse>(DirectFeedResponse());
-  result->url = feed_url;
   if (response_code < 200 || response_code >= 300 || body_content.empty()) {
     VLOG(1) << feed_url.spec()
             << " invalid response, status: " << response_code;
@@ -349,6 +431,9 @@ void DirectFeedController::OnResponse(
     return;
   }
   // Valid feed
+  if (!etag.empty() || !last_modified.empty()) {
+    feed_cache_[feed_url] = {etag, last_modified, data};
+  }
   result->success = true;
   result->data = data;
   std::move(callback).Run(std::move(result));
@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_BRAVE_TODAY_BROWSER_DIRECT_FEED_CONTROLLER_H_
 
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -29,6 +30,10 @@ class SimpleURLLoader;
 namespace brave_news {
 
 constexpr std::size_t kMaxArticlesPerDirectFeedSource = 100;
+// Limits on feed downloads in flight at once, so that users with many direct
+// feeds don't open a connection to each of them at the same time.
+constexpr std::size_t kMaxConcurrentDirectFeedDownloads = 6;
+constexpr std::size_t kMaxConcurrentDirectFeedDownloadsPerHost = 2;
 
 struct DirectFeedResponse {
  public:
@@ -65,16 +70,38 @@ class DirectFeedController {
  private:
   using SimpleURLLoaderList =
       std::list<std::unique_ptr<network::SimpleURLLoader>>;
+  // The validators and parsed data of the last download of a feed, so that
+  // the feed is only downloaded and parsed again once it has changed.
+  struct CachedFeed {
+    std::string etag;
+    std::string last_modified;
+    FeedData data;
+  };
+  struct PendingDownload {
+    GURL feed_url;
+    DownloadFeedCallback callback;
+  };
+
   void DownloadFeedContent(const GURL& feed_url,
                            const std::string& publisher_id,
                            GetArticlesCallback callback);
+  // Queues the download, which starts once the limits allow it.
   void DownloadFeed(const GURL& feed_url, DownloadFeedCallback callback);
+  void StartPendingDownloads();
+  void StartDownload(const GURL& feed_url, DownloadFeedCallback callback);
   void OnResponse(SimpleURLLoaderList::iterator iter,
                   DownloadFeedCallback callback,
                   const GURL& feed_url,
                   const std::unique_ptr<std::string> response_body);
 
   SimpleURLLoaderList url_loaders_;
+  std::list<PendingDownload> pending_downloads_;
+  // Feed downloads in flight, which unlike |url_loaders_| does not count
+  // the requests made by |FindFeeds|.
+  std::size_t active_downloads_ = 0;
+  // The number of feed downloads in flight for each host.
+  std::map<std::string, std::size_t> downloads_per_host_;
+  std::map<GURL, CachedFeed> feed_cache_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
 };
 
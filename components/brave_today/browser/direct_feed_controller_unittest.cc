@@ -3,16 +3,30 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this file,
 // you can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "brave/components/brave_today/browser/direct_feed_controller.h"
+
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <string>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/logging.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/run_loop.h"
+#include "base/strings/number_conversions.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
 #include "brave/components/brave_today/rust/lib.rs.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_util.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/public/mojom/url_response_head.mojom.h"
+#include "services/network/test/test_url_loader_factory.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace brave_news {
@@ -140,4 +154,138 @@ TEST(BraveNewsDirectFeed, ParseFeed) {
             "c5f85f34aa685221604f7e434415ca82");
 }
 
+TEST(BraveNewsDirectFeed, ReusesUnmodifiedFeed) {
+  base::test::TaskEnvironment task_environment;
+  network::TestURLLoaderFactory test_url_loader_factory;
+  DirectFeedController controller(
+      base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+          &test_url_loader_factory));
+
+  // The feed only has a body when the request isn't conditional
+  std::vector<std::string> sent_etags;
+  test_url_loader_factory.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        std::string etag;
+        request.headers.GetHeader(net::HttpRequestHeaders::kIfNoneMatch,
+                                  &etag);
+        sent_etags.push_back(etag);
+        auto head = network::mojom::URLResponseHead::New();
+        head->headers = base::MakeRefCounted<net::HttpResponseHeaders>(
+            net::HttpUtil::AssembleRawHeaders(
+                etag.empty() ? "HTTP/1.1 200 OK\nETag: \"v1\"\n\n"
+                             : "HTTP/1.1 304 Not Modified\n\n"));
+        test_url_loader_factory.AddResponse(
+            request.url, std::move(head), etag.empty() ? GetFeedJson() : "",
+            network::URLLoaderCompletionStatus());
+      }));
+
+  auto download_article_count = [&]() {
+    std::vector<mojom::PublisherPtr> publishers;
+    auto publisher = mojom::Publisher::New();
+    publisher->publisher_id = "publisher";
+    publisher->feed_source = GURL("https://www.example.com/feed.xml");
+    publishers.push_back(std::move(publisher));
+
+    size_t count = 0;
+    base::RunLoop run_loop;
+    controller.DownloadAllContent(
+        std::move(publishers),
+        base::BindLambdaForTesting([&](std::vector<mojom::FeedItemPtr> items) {
+          count = items.size();
+          run_loop.Quit();
+        }));
+    run_loop.Run();
+    return count;
+  };
+
+  EXPECT_EQ(download_article_count(), 3u);
+  EXPECT_EQ(download_article_count(), 3u);
+  EXPECT_EQ(sent_etags, std::vector<std::string>({"", "\"v1\""}));
+}
+
+TEST(BraveNewsDirectFeed, LimitsConcurrentDownloads) {
+  base::test::TaskEnvironment task_environment;
+  network::TestURLLoaderFactory test_url_loader_factory;
+  DirectFeedController controller(
+      base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+          &test_url_loader_factory));
+
+  // Three feeds share a host, the rest each have their own
+  std::vector<mojom::PublisherPtr> publishers;
+  for (size_t i = 0; i < kMaxConcurrentDirectFeedDownloads + 3; ++i) {
+    auto publisher = mojom::Publisher::New();
+    publisher->publisher_id = base::NumberToString(i);
+    publisher->feed_source =
+        i < 3 ? GURL("https://shared.example.com/feed" +
+                     base::NumberToString(i) + ".xml")
+              : GURL("https://" + base::NumberToString(i) +
+                     ".example.com/feed.xml");
+    publishers.push_back(std::move(publisher));
+  }
+
+  bool done = false;
+  controller.DownloadAllContent(
+      std::move(publishers),
+      base::BindLambdaForTesting(
+          [&](std::vector<mojom::FeedItemPtr> items) { done = true; }));
+  task_environment.RunUntilIdle();
+
+  EXPECT_EQ(test_url_loader_factory.NumPending(),
+            static_cast<int>(kMaxConcurrentDirectFeedDownloads));
+  size_t shared_host_count = 0;
+  for (const auto& pending : *test_url_loader_factory.pending_requests()) {
+    if (pending.request.url.host() == "shared.example.com") {
+      shared_host_count++;
+    }
+  }
+  EXPECT_EQ(shared_host_count, kMaxConcurrentDirectFeedDownloadsPerHost);
+
+  // Each finished download lets a queued one start, until all are done
+  while (test_url_loader_factory.NumPending() > 0) {
+    const GURL url = test_url_loader_factory.GetPendingRequest(0)->request.url;
+    test_url_loader_factory.SimulateResponseForPendingRequest(url.spec(),
+                                                              GetFeedJson());
+    task_environment.RunUntilIdle();
+    EXPECT_LE(test_url_loader_factory.NumPending(),
+              static_cast<int>(kMaxConcurrentDirectFeedDownloads));
+  }
+  EXPECT_TRUE(done);
+}
+
+TEST(BraveNewsDirectFeed, FindFeedsDoesNotTakeDownloadSlots) {
+  base::test::TaskEnvironment task_environment;
+  network::TestURLLoaderFactory test_url_loader_factory;
+  DirectFeedController controller(
+      base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+          &test_url_loader_factory));
+
+  // Leave a feed lookup in flight while feed content is downloaded
+  controller.FindFeeds(GURL("https://shared.example.com/"),
+                       base::BindLambdaForTesting(
+                           [](std::vector<mojom::FeedSearchResultItemPtr>) {}));
+  task_environment.RunUntilIdle();
+  ASSERT_EQ(test_url_loader_factory.NumPending(), 1);
+
+  std::vector<mojom::PublisherPtr> publishers;
+  for (size_t i = 0; i < kMaxConcurrentDirectFeedDownloads; ++i) {
+    auto publisher = mojom::Publisher::New();
+    publisher->publisher_id = base::NumberToString(i);
+    publisher->feed_source =
+        i < kMaxConcurrentDirectFeedDownloadsPerHost
+            ? GURL("https://shared.example.com/feed" +
+                   base::NumberToString(i) + ".xml")
+            : GURL("https://" + base::NumberToString(i) +
+                   ".example.com/feed.xml");
+    publishers.push_back(std::move(publisher));
+  }
+
+  controller.DownloadAllContent(
+      std::move(publishers),
+      base::BindLambdaForTesting([](std::vector<mojom::FeedItemPtr> items) {}));
+  task_environment.RunUntilIdle();
+
+  EXPECT_EQ(test_url_loader_factory.NumPending(),
+            static_cast<int>(kMaxConcurrentDirectFeedDownloads) + 1);
+}
+
 }  // namespace brave_news
@@ -26,6 +26,8 @@
 #include "brave/components/brave_today/common/brave_news.mojom.h"
 #include "components/history/core/browser/history_service.h"
 #include "components/history/core/browser/history_types.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_status_code.h"
 
 namespace brave_news {
 
@@ -233,6 +235,8 @@ void FeedController::UpdateIfRemoteChanged() {
 
 void FeedController::ClearCache() {
   ResetFeed();
+  current_feed_etag_.clear();
+  current_feed_items_.clear();
 }
 
 void FeedController::OnPublishersUpdated(PublishersController* controller) {
@@ -251,6 +255,17 @@ void FeedController::FetchCombinedFeed(GetFeedItemsCallback callback) {
           etag = headers.at(kEtagHeaderKey);
         }
         VLOG(1) << "Downloaded feed, status: " << status << " etag: " << etag;
+        // Feed is unchanged, so re-use the items parsed last time
+        if (status == net::HTTP_NOT_MODIFIED &&
+            !controller->current_feed_items_.empty()) {
+          FeedItems feed_items;
+          feed_items.reserve(controller->current_feed_items_.size());
+          for (const auto& item : controller->current_feed_items_) {
+            feed_items.push_back(item->Clone());
+          }
+          std::move(callback).Run(std::move(feed_items));
+          return;
+        }
         // Handle bad response
         if (status != 200 || body.empty()) {
           LOG(ERROR) << "Bad response from brave news feed.json. Status: "
@@ -263,15 +278,24 @@ void FeedController::FetchCombinedFeed(GetFeedItemsCallback callback) {
         controller->current_feed_etag_ = etag;
         FeedItems feed_items;
         ParseFeedItems(body, &feed_items);
+        controller->current_feed_items_.clear();
+        controller->current_feed_items_.reserve(feed_items.size());
+        for (const auto& item : feed_items) {
+          controller->current_feed_items_.push_back(item->Clone());
+        }
         std::move(callback).Run(std::move(feed_items));
       },
       base::Unretained(this), std::move(callback));
-  // Send the request
+  // Send the request, only asking for the body if it changed since the
+  // items we have were parsed.
   GURL feed_url(GetFeedUrl());
   VLOG(1) << "Making feed request to " << feed_url.spec();
+  auto headers = brave::private_cdn_headers;
+  if (!current_feed_etag_.empty() && !current_feed_items_.empty()) {
+    headers[net::HttpRequestHeaders::kIfNoneMatch] = current_feed_etag_;
+  }
   api_request_helper_->Request("GET", feed_url, "", "", true,
-                               std::move(response_handler),
-                               brave::private_cdn_headers);
+                               std::move(response_handler), headers);
 }
 
 void FeedController::GetOrFetchFeed(base::OnceClosure callback) {
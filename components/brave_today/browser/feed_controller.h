@@ -85,6 +85,9 @@ class FeedController : public PublishersController::Observer {
   // every time the UI opens.
   mojom::Feed current_feed_;
   std::string current_feed_etag_;
+  // The items parsed from the combined feed with |current_feed_etag_|, re-used
+  // while the remote feed is unchanged.
+  FeedItems current_feed_items_;
   bool is_update_in_progress_ = false;
 };
 
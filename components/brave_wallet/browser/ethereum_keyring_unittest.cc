@@ -71,6 +71,8 @@ TEST(EthereumKeyringUnitTest, Accounts) {
   keyring.RemoveAccount();
   accounts = keyring.GetAccounts();
   EXPECT_EQ(accounts.size(), 2u);
+  EXPECT_FALSE(
+      keyring.GetAccountIndex("0x02e77f0e2fa06F95BDEa79Fad158477723145838"));
   EXPECT_EQ(keyring.GetAddress(0),
             "0x2166fB4e11D44100112B1124ac593081519cA1ec");
   EXPECT_EQ(keyring.GetAddress(1),
@@ -122,7 +124,7 @@ TEST(EthereumKeyringUnitTest, SignMessage) {
   key->SetPrivateKey(private_key);
 
   EthereumKeyring keyring;
-  keyring.accounts_.push_back(std::move(key));
+  keyring.AddAccount(std::move(key));
   EXPECT_EQ(keyring.GetAddress(0),
             "0xbE93f9BacBcFFC8ee6663f2647917ed7A20a57BB");
 
@@ -27,27 +27,21 @@ void HDKeyring::AddAccounts(size_t number) {
   size_t cur_accounts_number = accounts_.size();
   for (size_t i = cur_accounts_number; i < cur_accounts_number + number; ++i) {
     if (root_) {
-      accounts_.push_back(root_->DeriveChild(i));
+      AddAccount(root_->DeriveChild(i));
     }
   }
 }
 
 std::vector<std::string> HDKeyring::GetAccounts() const {
-  std::vector<std::string> addresses;
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    addresses.push_back(GetAddress(i));
-  }
-  return addresses;
+  return account_addresses_;
 }
 
 absl::optional<size_t> HDKeyring::GetAccountIndex(
     const std::string& address) const {
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address) {
-      return i;
-    }
-  }
-  return absl::nullopt;
+  const auto it = account_indices_.find(address);
+  if (it == account_indices_.end())
+    return absl::nullopt;
+  return it->second;
 }
 
 size_t HDKeyring::GetAccountsNumber() const {
@@ -55,6 +49,10 @@ size_t HDKeyring::GetAccountsNumber() const {
 }
 
 void HDKeyring::RemoveAccount() {
+  const auto it = account_indices_.find(account_addresses_.back());
+  if (it != account_indices_.end() && it->second == accounts_.size() - 1)
+    account_indices_.erase(it);
+  account_addresses_.pop_back();
   accounts_.pop_back();
 }
 
@@ -64,10 +62,8 @@ bool HDKeyring::AddImportedAddress(const std::string& address,
   if (imported_accounts_[address])
     return false;
   // Check if it is duplicate in derived accounts
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address)
-      return false;
-  }
+  if (GetAccountIndex(address))
+    return false;
 
   imported_accounts_[address] = std::move(hd_key);
   return true;
@@ -95,9 +91,9 @@ bool HDKeyring::RemoveImportedAccount(const std::string& address) {
 }
 
 std::string HDKeyring::GetAddress(size_t index) const {
-  if (accounts_.empty() || index >= accounts_.size())
+  if (index >= account_addresses_.size())
     return std::string();
-  return GetAddressInternal(accounts_[index].get());
+  return account_addresses_[index];
 }
 
 std::string HDKeyring::GetDiscoveryAddress(size_t index) const {
@@ -129,11 +125,18 @@ HDKeyBase* HDKeyring::GetHDKeyFromAddress(const std::string& address) {
   const auto imported_accounts_iter = imported_accounts_.find(address);
   if (imported_accounts_iter != imported_accounts_.end())
     return imported_accounts_iter->second.get();
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address)
-      return accounts_[i].get();
-  }
+  if (auto index = GetAccountIndex(address))
+    return accounts_[*index].get();
   return nullptr;
 }
 
+void HDKeyring::AddAccount(std::unique_ptr<HDKeyBase> hd_key) {
+  std::string address = GetAddressInternal(hd_key.get());
+  // Keep the first index for a repeated address, as the lookups used to.
+  if (!address.empty())
+    account_indices_.emplace(address, accounts_.size());
+  account_addresses_.push_back(std::move(address));
+  accounts_.push_back(std::move(hd_key));
+}
+
 }  // namespace brave_wallet
@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "base/containers/flat_map.h"
@@ -59,10 +60,17 @@ class HDKeyring {
   bool AddImportedAddress(const std::string& address,
                           std::unique_ptr<HDKeyBase> hd_key);
   HDKeyBase* GetHDKeyFromAddress(const std::string& address);
+  // Appends a derived account and caches its address.
+  void AddAccount(std::unique_ptr<HDKeyBase> hd_key);
 
   std::unique_ptr<HDKeyBase> root_;
   std::unique_ptr<HDKeyBase> master_key_;
   std::vector<std::unique_ptr<HDKeyBase>> accounts_;
+  // Addresses of |accounts_|, so that they aren't recomputed from the public
+  // keys each time accounts are listed or looked up.
+  std::vector<std::string> account_addresses_;
+  // (address, index in |accounts_|)
+  std::unordered_map<std::string, size_t> account_indices_;
   // (address, key)
   base::flat_map<std::string, std::unique_ptr<HDKeyBase>> imported_accounts_;
 
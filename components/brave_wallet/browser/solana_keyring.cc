@@ -38,7 +38,7 @@ void SolanaKeyring::AddAccounts(size_t number) {
   size_t cur_accounts_number = accounts_.size();
   for (size_t i = cur_accounts_number; i < cur_accounts_number + number; ++i) {
     if (root_) {
-      accounts_.push_back(root_->DeriveChild(i)->DeriveChild(0));
+      AddAccount(root_->DeriveChild(i)->DeriveChild(0));
     }
   }
 }
@@ -4,6 +4,8 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "base/strings/string_number_conversions.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
@@ -115,6 +117,50 @@ TEST(SolanaKeyringUnitTest, SignMessage) {
   EXPECT_EQ(signature, expected_signature);
 }
 
+TEST(SolanaKeyringUnitTest, RemoveAccount) {
+  SolanaKeyring keyring;
+  std::unique_ptr<std::vector<uint8_t>> seed =
+      MnemonicToSeed(std::string(mnemonic), "");
+  keyring.ConstructRootHDKey(*seed, "m/44'/501'");
+
+  keyring.AddAccounts(3);
+  const std::vector<std::string> accounts = keyring.GetAccounts();
+  ASSERT_EQ(accounts.size(), 3u);
+
+  // Message: Hello Brave
+  const std::vector<uint8_t> message = {72, 101, 108, 108, 111, 32,
+                                        66, 114, 97,  118, 101};
+  const std::vector<uint8_t> signature =
+      keyring.SignMessage(accounts[0], message);
+  EXPECT_FALSE(signature.empty());
+
+  // remove every account, including the last one
+  for (size_t i = accounts.size(); i > 0; --i) {
+    keyring.RemoveAccount();
+    EXPECT_EQ(keyring.GetAccountsNumber(), i - 1);
+    EXPECT_EQ(keyring.GetAccounts(),
+              std::vector<std::string>(accounts.begin(),
+                                       accounts.begin() + i - 1));
+    EXPECT_FALSE(keyring.GetAccountIndex(accounts[i - 1]));
+    EXPECT_TRUE(keyring.GetAddress(i - 1).empty());
+    EXPECT_TRUE(keyring.SignMessage(accounts[i - 1], message).empty());
+    for (size_t j = 0; j < i - 1; ++j) {
+      EXPECT_EQ(keyring.GetAccountIndex(accounts[j]), j);
+    }
+  }
+  EXPECT_TRUE(keyring.GetAccounts().empty());
+
+  // accounts added back are derived at the same indices
+  keyring.AddAccounts(2);
+  EXPECT_EQ(keyring.GetAccounts(),
+            std::vector<std::string>(accounts.begin(), accounts.begin() + 2));
+  EXPECT_EQ(keyring.GetAccountIndex(accounts[0]), 0u);
+  EXPECT_EQ(keyring.GetAccountIndex(accounts[1]), 1u);
+  EXPECT_FALSE(keyring.GetAccountIndex(accounts[2]));
+  EXPECT_EQ(keyring.SignMessage(accounts[0], message), signature);
+  EXPECT_TRUE(keyring.SignMessage(accounts[2], message).empty());
+}
+
 TEST(SolanaKeyringUnitTest, ImportAccount) {
   SolanaKeyring keyring;
   std::vector<uint8_t> private_key;
@@ -468,6 +468,7 @@ void NTPBackgroundImagesService::OnComponentReady(
 
 void NTPBackgroundImagesService::OnGetComponentJsonData(
     const std::string& json_string) {
+  image_file_cache_.Clear();
   bi_images_data_.reset(
       new NTPBackgroundImagesData(json_string, bi_installed_dir_));
 
@@ -498,6 +499,7 @@ void NTPBackgroundImagesService::OnSponsoredComponentReady(
 void NTPBackgroundImagesService::OnGetSponsoredComponentJsonData(
     bool is_super_referral,
     const std::string& json_string) {
+  image_file_cache_.Clear();
   if (is_super_referral) {
     local_pref_->SetBoolean(
           prefs::kNewTabPageGetInitialSRComponentInProgress,
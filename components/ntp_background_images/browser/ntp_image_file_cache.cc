@@ -0,0 +1,99 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_file_cache.h"
+
+#include <string>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/containers/contains.h"
+#include "base/files/file_util.h"
+#include "base/task/thread_pool.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+
+namespace ntp_background_images {
+
+namespace {
+
+// Enough for the wallpaper being shown, the one prefetched for the next new
+// tab and their sponsored logos.
+constexpr size_t kMaxCachedImages = 4;
+
+scoped_refptr<base::RefCountedMemory> ReadImageFileOnThreadPool(
+    const base::FilePath& path) {
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents))
+    return nullptr;
+  // Takes over the buffer instead of copying it.
+  return base::RefCountedString::TakeString(&contents);
+}
+
+}  // namespace
+
+NTPImageFileCache::NTPImageFileCache() : images_(kMaxCachedImages) {}
+
+NTPImageFileCache::~NTPImageFileCache() = default;
+
+void NTPImageFileCache::GetImage(const base::FilePath& image_file_path,
+                                 GetImageCallback callback) {
+  auto it = images_.Get(image_file_path);
+  if (it != images_.end()) {
+    base::SequencedTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE, base::BindOnce(std::move(callback), it->second));
+    return;
+  }
+
+  // Wait on the read already in flight, if any.
+  auto pending_read = pending_reads_.find(image_file_path);
+  if (pending_read != pending_reads_.end()) {
+    pending_read->second.push_back(std::move(callback));
+    return;
+  }
+
+  pending_reads_[image_file_path].push_back(std::move(callback));
+  ReadImageFile(image_file_path);
+}
+
+void NTPImageFileCache::Prefetch(const base::FilePath& image_file_path) {
+  if (image_file_path.empty() ||
+      images_.Peek(image_file_path) != images_.end() ||
+      base::Contains(pending_reads_, image_file_path)) {
+    return;
+  }
+
+  // Registers the read as in flight without anyone waiting on it yet.
+  pending_reads_[image_file_path];
+  ReadImageFile(image_file_path);
+}
+
+void NTPImageFileCache::Clear() {
+  images_.Clear();
+}
+
+void NTPImageFileCache::ReadImageFile(const base::FilePath& image_file_path) {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&ReadImageFileOnThreadPool, image_file_path),
+      base::BindOnce(&NTPImageFileCache::OnReadImageFile,
+                     weak_factory_.GetWeakPtr(), image_file_path));
+}
+
+void NTPImageFileCache::OnReadImageFile(
+    const base::FilePath& image_file_path,
+    scoped_refptr<base::RefCountedMemory> bytes) {
+  if (bytes)
+    images_.Put(image_file_path, bytes);
+
+  auto it = pending_reads_.find(image_file_path);
+  if (it == pending_reads_.end())
+    return;
+  std::vector<GetImageCallback> callbacks = std::move(it->second);
+  pending_reads_.erase(it);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(bytes);
+}
+
+}  // namespace ntp_background_images
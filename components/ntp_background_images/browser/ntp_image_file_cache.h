@@ -0,0 +1,58 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_FILE_CACHE_H_
+#define BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_FILE_CACHE_H_
+
+#include <map>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
+
+namespace ntp_background_images {
+
+// Keeps the bytes of the last few wallpaper image files served to new tab
+// pages, so that showing the same or the next wallpaper doesn't read its file
+// from disk again on the new tab page's critical path.
+class NTPImageFileCache {
+ public:
+  using GetImageCallback =
+      base::OnceCallback<void(scoped_refptr<base::RefCountedMemory>)>;
+
+  NTPImageFileCache();
+  ~NTPImageFileCache();
+
+  NTPImageFileCache(const NTPImageFileCache&) = delete;
+  NTPImageFileCache& operator=(const NTPImageFileCache&) = delete;
+
+  // Runs |callback| with the bytes of |image_file_path|, or with null if it
+  // can't be read. The callback runs asynchronously even on a cache hit.
+  void GetImage(const base::FilePath& image_file_path,
+                GetImageCallback callback);
+  // Reads |image_file_path| into the cache ahead of it being asked for.
+  void Prefetch(const base::FilePath& image_file_path);
+  void Clear();
+
+ private:
+  void ReadImageFile(const base::FilePath& image_file_path);
+  void OnReadImageFile(const base::FilePath& image_file_path,
+                       scoped_refptr<base::RefCountedMemory> bytes);
+
+  base::LRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>>
+      images_;
+  // Callbacks waiting on reads in flight, so that a file being prefetched
+  // isn't read a second time when it's asked for.
+  std::map<base::FilePath, std::vector<GetImageCallback>> pending_reads_;
+  base::WeakPtrFactory<NTPImageFileCache> weak_factory_{this};
+};
+
+}  // namespace ntp_background_images
+
+#endif  // BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_FILE_CACHE_H_
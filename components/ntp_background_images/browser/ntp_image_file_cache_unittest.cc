@@ -0,0 +1,67 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_file_cache.h"
+
+#include <string>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/run_loop.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ntp_background_images {
+
+class NTPImageFileCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    image_file_path_ = temp_dir_.GetPath().AppendASCII("wallpaper.jpg");
+    ASSERT_TRUE(base::WriteFile(image_file_path_, "image bytes"));
+  }
+
+  std::string GetImage() {
+    std::string result = "none";
+    base::RunLoop run_loop;
+    cache_.GetImage(
+        image_file_path_,
+        base::BindLambdaForTesting(
+            [&](scoped_refptr<base::RefCountedMemory> bytes) {
+              if (bytes)
+                result.assign(bytes->front_as<char>(), bytes->size());
+              run_loop.Quit();
+            }));
+    run_loop.Run();
+    return result;
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  base::FilePath image_file_path_;
+  NTPImageFileCache cache_;
+};
+
+TEST_F(NTPImageFileCacheTest, ServesCachedBytes) {
+  EXPECT_EQ(GetImage(), "image bytes");
+
+  // The file isn't read again.
+  ASSERT_TRUE(base::DeleteFile(image_file_path_));
+  EXPECT_EQ(GetImage(), "image bytes");
+
+  cache_.Clear();
+  EXPECT_EQ(GetImage(), "none");
+}
+
+TEST_F(NTPImageFileCacheTest, PrefetchedImage) {
+  cache_.Prefetch(image_file_path_);
+  task_environment_.RunUntilIdle();
+
+  ASSERT_TRUE(base::DeleteFile(image_file_path_));
+  EXPECT_EQ(GetImage(), "image bytes");
+}
+
+}  // namespace ntp_background_images
@@ -265,6 +265,22 @@ void ViewCounterService::RegisterPageView() {
   // This will be no-op when component is not ready.
   service_->CheckNTPSIComponentUpdateIfNeeded();
   model_.RegisterPageView();
+  PrefetchCurrentWallpaper();
+}
+
+void ViewCounterService::PrefetchCurrentWallpaper() {
+  // The model has moved on to the wallpaper the next new tab page will show,
+  // so read it while nothing is waiting on it yet.
+  const base::Value data = GetCurrentWallpaperForDisplay();
+  if (!data.is_dict())
+    return;
+
+  // Custom backgrounds have no image path, and are served elsewhere.
+  if (const std::string* image_path =
+          data.FindStringKey(kWallpaperImagePathKey)) {
+    service_->image_file_cache()->Prefetch(
+        base::FilePath::FromUTF8Unsafe(*image_path));
+  }
 }
 
 void ViewCounterService::BrandedWallpaperLogoClicked(
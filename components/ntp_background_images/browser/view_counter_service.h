@@ -141,6 +141,8 @@ class ViewCounterService : public KeyedService,
   bool ShouldShowBrandedWallpaper() const;
 
   void ResetModel();
+  // Reads the wallpaper for the next new tab page into the image file cache.
+  void PrefetchCurrentWallpaper();
 
   void UpdateP3AValues() const;
 
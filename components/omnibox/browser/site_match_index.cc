@@ -0,0 +1,70 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/site_match_index.h"
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+SiteMatchIndex::SiteMatchIndex(std::vector<std::string> sites,
+                               MatchType match_type)
+    : sites_(std::move(sites)) {
+  for (uint32_t index = 0; index < sites_.size(); ++index) {
+    // Every site gets at least its whole string, even when it is empty.
+    const uint32_t suffix_count =
+        match_type == MatchType::kPrefix
+            ? 1
+            : std::max<uint32_t>(sites_[index].length(), 1);
+    for (uint32_t position = 0; position < suffix_count; ++position)
+      suffixes_.push_back({index, position});
+  }
+  std::sort(suffixes_.begin(), suffixes_.end(),
+            [this](const Suffix& lhs, const Suffix& rhs) {
+              return GetSuffix(lhs) < GetSuffix(rhs);
+            });
+}
+
+SiteMatchIndex::~SiteMatchIndex() = default;
+
+std::vector<SiteMatchIndex::Match> SiteMatchIndex::FindMatches(
+    base::StringPiece query,
+    size_t max_matches) const {
+  // Suffixes starting with |query| are adjacent in the sorted index.
+  auto begin = std::lower_bound(
+      suffixes_.begin(), suffixes_.end(), query,
+      [this](const Suffix& suffix, base::StringPiece query) {
+        return GetSuffix(suffix).substr(0, query.length()) < query;
+      });
+  auto end = std::upper_bound(
+      begin, suffixes_.end(), query,
+      [this](base::StringPiece query, const Suffix& suffix) {
+        return query < GetSuffix(suffix).substr(0, query.length());
+      });
+
+  std::vector<Match> matches;
+  matches.reserve(end - begin);
+  for (auto it = begin; it != end; ++it)
+    matches.push_back({it->index, it->position});
+
+  // A site can hold the query more than once; keep its first occurrence.
+  std::sort(matches.begin(), matches.end(),
+            [](const Match& lhs, const Match& rhs) {
+              return std::tie(lhs.index, lhs.position) <
+                     std::tie(rhs.index, rhs.position);
+            });
+  matches.erase(std::unique(matches.begin(), matches.end(),
+                            [](const Match& lhs, const Match& rhs) {
+                              return lhs.index == rhs.index;
+                            }),
+                matches.end());
+  if (matches.size() > max_matches)
+    matches.resize(max_matches);
+  return matches;
+}
+
+base::StringPiece SiteMatchIndex::GetSuffix(const Suffix& suffix) const {
+  return base::StringPiece(sites_[suffix.index]).substr(suffix.position);
+}
@@ -0,0 +1,58 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITE_MATCH_INDEX_H_
+#define BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITE_MATCH_INDEX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "base/strings/string_piece.h"
+
+// Sorted suffix index over a fixed list of lowercase site strings, so that
+// providers can look up the sites containing (or starting with) the input
+// without scanning the whole list on every keystroke.
+class SiteMatchIndex {
+ public:
+  enum class MatchType {
+    // Sites containing the query anywhere.
+    kSubstring,
+    // Sites starting with the query.
+    kPrefix,
+  };
+
+  struct Match {
+    // Position of the site in the list the index was built from.
+    size_t index;
+    // Offset of the first occurrence of the query in the site.
+    size_t position;
+  };
+
+  SiteMatchIndex(std::vector<std::string> sites, MatchType match_type);
+  ~SiteMatchIndex();
+
+  SiteMatchIndex(const SiteMatchIndex&) = delete;
+  SiteMatchIndex& operator=(const SiteMatchIndex&) = delete;
+
+  // Returns at most |max_matches| sites matching |query|, in list order.
+  std::vector<Match> FindMatches(base::StringPiece query,
+                                 size_t max_matches) const;
+
+ private:
+  struct Suffix {
+    uint32_t index;
+    uint32_t position;
+  };
+
+  base::StringPiece GetSuffix(const Suffix& suffix) const;
+
+  const std::vector<std::string> sites_;
+  std::vector<Suffix> suffixes_;
+};
+
+#endif  // BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITE_MATCH_INDEX_H_
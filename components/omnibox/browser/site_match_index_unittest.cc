@@ -0,0 +1,41 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/site_match_index.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+TEST(SiteMatchIndexTest, SubstringMatchesInListOrder) {
+  SiteMatchIndex index({"dex.com", "index.com", "example.com", "dexdex.org"},
+                       SiteMatchIndex::MatchType::kSubstring);
+
+  auto matches = index.FindMatches("dex", 10);
+  ASSERT_EQ(matches.size(), 3u);
+  EXPECT_EQ(matches[0].index, 0u);
+  EXPECT_EQ(matches[0].position, 0u);
+  EXPECT_EQ(matches[1].index, 1u);
+  EXPECT_EQ(matches[1].position, 2u);
+  // The first occurrence is reported.
+  EXPECT_EQ(matches[2].index, 3u);
+  EXPECT_EQ(matches[2].position, 0u);
+
+  matches = index.FindMatches("dex", 2);
+  ASSERT_EQ(matches.size(), 2u);
+  EXPECT_EQ(matches[1].index, 1u);
+
+  EXPECT_TRUE(index.FindMatches("brave", 10).empty());
+}
+
+TEST(SiteMatchIndexTest, PrefixMatches) {
+  SiteMatchIndex index({"bitcoin", "litecoin", "bitcoin cash"},
+                       SiteMatchIndex::MatchType::kPrefix);
+
+  EXPECT_TRUE(index.FindMatches("coin", 10).empty());
+
+  auto matches = index.FindMatches("bitc", 10);
+  ASSERT_EQ(matches.size(), 2u);
+  EXPECT_EQ(matches[0].index, 0u);
+  EXPECT_EQ(matches[1].index, 2u);
+}
@@ -16,6 +16,7 @@
 #include "components/omnibox/browser/autocomplete_provider.h"
 
 class AutocompleteProviderClient;
+class SiteMatchIndex;
 
 // This is the provider for Brave Suggested Sites
 class SuggestedSitesProvider : public AutocompleteProvider {
@@ -33,6 +34,8 @@ class SuggestedSitesProvider : public AutocompleteProvider {
   static const int kRelevance;
 
   const std::vector<SuggestedSitesMatch>& GetSuggestedSites();
+  // Index over the match strings of GetSuggestedSites(), built on first use.
+  const SiteMatchIndex& GetSuggestedSitesIndex();
   void AddMatch(const SuggestedSitesMatch& match,
                 const ACMatchClassifications& styles);
 
@@ -15,6 +15,7 @@
 #include "components/omnibox/browser/autocomplete_provider.h"
 
 class AutocompleteProviderClient;
+class SiteMatchIndex;
 
 // This is the provider for top Alexa 500 sites URLs
 class TopSitesProvider : public AutocompleteProvider {
@@ -33,6 +34,9 @@ class TopSitesProvider : public AutocompleteProvider {
 
   static std::vector<std::string> top_sites_;
 
+  // Index over |top_sites_|, built on first use.
+  static const SiteMatchIndex& GetTopSitesIndex();
+
   void AddMatch(const std::u16string& match_string,
                 const ACMatchClassifications& styles);
 
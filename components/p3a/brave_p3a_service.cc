@@ -49,7 +49,6 @@ namespace {
 // Receiving this value will effectively prevent the metric from transmission
 // to the backend. For now we consider this as a hack for p2a metrics, which
 // should be refactored in better times.
-constexpr int32_t kSuspendedMetricValue = INT_MAX - 1;
 constexpr uint64_t kSuspendedMetricBucket = INT_MAX - 1;
 
 constexpr char kLastRotationTimeStampPref[] = "p3a.last_rotation_timestamp";
@@ -62,6 +61,10 @@ constexpr char kP2AJsonServerUrl[] = "https://p2a-json.brave.com/";
 
 constexpr uint64_t kDefaultUploadIntervalSeconds = 60;  // 1 minute.
 
+// Histogram changes are handed to the UI thread in batches at most this
+// often, keeping only the latest bucket of each histogram.
+constexpr base::TimeDelta kHistogramFlushDelay = base::Seconds(1);
+
 bool IsSuspendedMetric(base::StringPiece metric_name,
                        uint64_t value_or_bucket) {
   return value_or_bucket == kSuspendedMetricBucket;
@@ -324,15 +327,10 @@ void BraveP3AService::OnHistogramChanged(const char* histogram_name,
   if (samples->Iterator()->Done())
     return;
 
-  // Shortcut for the special values, see |kSuspendedMetricValue|
+  // Shortcut for the special values, see |kSuspendedMetricBucket|
   // description for details.
   if (IsSuspendedMetric(histogram_name, sample)) {
-    base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                   base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI,
-                                  this,
-                                  histogram_name,
-                                  kSuspendedMetricValue,
-                                  kSuspendedMetricBucket));
+    QueueHistogramChange(histogram_name, kSuspendedMetricBucket);
     return;
   }
 
@@ -361,21 +359,42 @@ void BraveP3AService::OnHistogramChanged(const char* histogram_name,
     bucket = DirectEncodingProtocol::Perturb(bucket_count, bucket);
   }
 
-  base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                 base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI, this,
-                                histogram_name, sample, bucket));
+  QueueHistogramChange(histogram_name, bucket);
 }
 
-void BraveP3AService::OnHistogramChangedOnUI(const char* histogram_name,
-                                             base::HistogramBase::Sample sample,
-                                             size_t bucket) {
-  VLOG(2) << "BraveP3AService::OnHistogramChanged: histogram_name = "
-          << histogram_name << " Sample = " << sample << " bucket = " << bucket;
-  if (!initialized_) {
-    // Will handle it later when ready.
-    histogram_values_[histogram_name] = bucket;
-  } else {
-    HandleHistogramChange(histogram_name, bucket);
+void BraveP3AService::QueueHistogramChange(const char* histogram_name,
+                                           size_t bucket) {
+  bool is_flush_scheduled;
+  {
+    base::AutoLock lock(pending_histogram_values_lock_);
+    is_flush_scheduled = !pending_histogram_values_.empty();
+    pending_histogram_values_[histogram_name] = bucket;
+  }
+  if (is_flush_scheduled)
+    return;
+
+  base::PostDelayedTask(
+      FROM_HERE, {content::BrowserThread::UI},
+      base::BindOnce(&BraveP3AService::FlushHistogramChangesOnUI, this),
+      kHistogramFlushDelay);
+}
+
+void BraveP3AService::FlushHistogramChangesOnUI() {
+  base::flat_map<base::StringPiece, size_t> histogram_values;
+  {
+    base::AutoLock lock(pending_histogram_values_lock_);
+    histogram_values.swap(pending_histogram_values_);
+  }
+
+  for (const auto& entry : histogram_values) {
+    VLOG(2) << "BraveP3AService::OnHistogramChanged: histogram_name = "
+            << entry.first << " bucket = " << entry.second;
+    if (!initialized_) {
+      // Will handle it later when ready.
+      histogram_values_[entry.first] = entry.second;
+    } else {
+      HandleHistogramChange(entry.first, entry.second);
+    }
   }
 }
 
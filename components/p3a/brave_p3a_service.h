@@ -15,6 +15,8 @@
 #include "base/metrics/histogram_base.h"
 #include "base/metrics/statistics_recorder.h"
 #include "base/strings/string_piece_forward.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "base/timer/wall_clock_timer.h"
 #include "brave/components/p3a/brave_p3a_log_store.h"
 #include "brave/components/p3a/p3a_message.h"
@@ -83,9 +85,11 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
                           uint64_t name_hash,
                           base::HistogramBase::Sample sample);
 
-  void OnHistogramChangedOnUI(const char* histogram_name,
-                              base::HistogramBase::Sample sample,
-                              size_t bucket);
+  // Records the latest bucket of a histogram, and schedules a flush to the UI
+  // thread unless one is already pending. Can be called on any thread.
+  void QueueHistogramChange(const char* histogram_name, size_t bucket);
+
+  void FlushHistogramChangesOnUI();
 
   // Updates or removes a metric from the log.
   void HandleHistogramChange(base::StringPiece histogram_name, size_t bucket);
@@ -124,6 +128,12 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   // the service and its initialization.
   base::flat_map<base::StringPiece, size_t> histogram_values_;
 
+  // Histogram changes not yet handed to the UI thread, see
+  // |QueueHistogramChange|.
+  base::Lock pending_histogram_values_lock_;
+  base::flat_map<base::StringPiece, size_t> pending_histogram_values_
+      GUARDED_BY(pending_histogram_values_lock_);
+
   // Once fired we restart the overall uploading process.
   base::WallClockTimer rotation_timer_;
 
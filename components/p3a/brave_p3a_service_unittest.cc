@@ -0,0 +1,135 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/p3a/brave_p3a_service.h"
+
+#include <climits>
+#include <memory>
+#include <string>
+
+#include "base/memory/scoped_refptr.h"
+#include "base/metrics/histogram_functions.h"
+#include "base/metrics/statistics_recorder.h"
+#include "base/time/time.h"
+#include "base/values.h"
+#include "brave/components/brave_referrals/common/pref_names.h"
+#include "components/prefs/testing_pref_service.h"
+#include "content/public/test/browser_task_environment.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave {
+
+namespace {
+
+constexpr char kTabCountHistogramName[] = "Brave.Core.TabCount";
+constexpr char kWindowCountHistogramName[] = "Brave.Core.WindowCount.2";
+constexpr char kP2AHistogramName[] = "Brave.P2A.TotalAdOpportunities";
+
+// Matches |kHistogramFlushDelay| in brave_p3a_service.cc.
+constexpr base::TimeDelta kHistogramFlushDelay = base::Seconds(1);
+
+}  // namespace
+
+class BraveP3AServiceTest : public testing::Test {
+ protected:
+  BraveP3AServiceTest()
+      : task_environment_(
+            content::BrowserTaskEnvironment::TimeSource::MOCK_TIME),
+        statistics_recorder_(
+            base::StatisticsRecorder::CreateTemporaryForTesting()),
+        shared_url_loader_factory_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &url_loader_factory_)) {}
+
+  void SetUp() override {
+    BraveP3AService::RegisterPrefs(local_state_.registry(), false);
+    local_state_.registry()->RegisterStringPref(kReferralPromoCode,
+                                                std::string());
+
+    service_ = base::MakeRefCounted<BraveP3AService>(&local_state_, "release",
+                                                     "2022-01-01");
+    service_->InitCallbacks();
+    service_->Init(shared_url_loader_factory_);
+  }
+
+  // Histogram observers are notified asynchronously, and the service reads
+  // each change as a delta, so each sample is handed over before the next.
+  // This doesn't advance the mock clock, so the flush is still pending.
+  void RecordHistogram(const char* histogram_name,
+                       int sample,
+                       int exclusive_max) {
+    base::UmaHistogramExactLinear(histogram_name, sample, exclusive_max);
+    task_environment_.RunUntilIdle();
+  }
+
+  // Returns the value of |histogram_name| in the log store, or an empty string
+  // if it isn't there.
+  std::string GetLoggedValue(const std::string& histogram_name) {
+    // Histogram names contain dots, so they can't be looked up as a path
+    const base::Value* log =
+        local_state_.GetDictionary("p3a.logs")->FindDictKey(histogram_name);
+    if (!log) {
+      return std::string();
+    }
+
+    const std::string* value = log->FindStringKey("value");
+    return value ? *value : std::string();
+  }
+
+  content::BrowserTaskEnvironment task_environment_;
+  std::unique_ptr<base::StatisticsRecorder> statistics_recorder_;
+  TestingPrefServiceSimple local_state_;
+  network::TestURLLoaderFactory url_loader_factory_;
+  scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
+  scoped_refptr<BraveP3AService> service_;
+};
+
+TEST_F(BraveP3AServiceTest, HistogramChangesAreFlushedTogether) {
+  RecordHistogram(kTabCountHistogramName, 1, 4);
+  RecordHistogram(kWindowCountHistogramName, 2, 3);
+  RecordHistogram(kTabCountHistogramName, 3, 4);
+
+  // Nothing reaches the log store until the batch is flushed
+  EXPECT_EQ(GetLoggedValue(kTabCountHistogramName), "");
+  EXPECT_EQ(GetLoggedValue(kWindowCountHistogramName), "");
+
+  task_environment_.FastForwardBy(kHistogramFlushDelay);
+
+  // Only the last change of each histogram is kept
+  EXPECT_EQ(GetLoggedValue(kTabCountHistogramName), "3");
+  EXPECT_EQ(GetLoggedValue(kWindowCountHistogramName), "2");
+}
+
+TEST_F(BraveP3AServiceTest, ChangesAfterAFlushAreFlushedInTheNextBatch) {
+  RecordHistogram(kTabCountHistogramName, 1, 4);
+  task_environment_.FastForwardBy(kHistogramFlushDelay);
+  EXPECT_EQ(GetLoggedValue(kTabCountHistogramName), "1");
+
+  RecordHistogram(kTabCountHistogramName, 2, 4);
+  EXPECT_EQ(GetLoggedValue(kTabCountHistogramName), "1");
+
+  task_environment_.FastForwardBy(kHistogramFlushDelay);
+  EXPECT_EQ(GetLoggedValue(kTabCountHistogramName), "2");
+}
+
+TEST_F(BraveP3AServiceTest, SuspendedHistogramIsRemovedFromLogStore) {
+  RecordHistogram(kP2AHistogramName, 1, 9);
+  task_environment_.FastForwardBy(kHistogramFlushDelay);
+  // The bucket of P2A histograms is perturbed, so only check it was logged
+  EXPECT_NE(GetLoggedValue(kP2AHistogramName), "");
+
+  // Recorded as the special value that suspends the metric, see
+  // |brave_ads::SuspendP2AHistograms|
+  RecordHistogram(kTabCountHistogramName, 2, 4);
+  RecordHistogram(kP2AHistogramName, INT_MAX, 9);
+  task_environment_.FastForwardBy(kHistogramFlushDelay);
+
+  EXPECT_EQ(GetLoggedValue(kP2AHistogramName), "");
+  EXPECT_EQ(GetLoggedValue(kTabCountHistogramName), "2");
+}
+
+}  // namespace brave
@@ -1096,11 +1096,13 @@ void BatLedgerImpl::OnShutdown(
   delete holder;
 }
 
-void BatLedgerImpl::Shutdown(ShutdownCallback callback) {
+void BatLedgerImpl::Shutdown(bool discard_pending_visits,
+                             ShutdownCallback callback) {
   auto* holder = new CallbackHolder<ShutdownCallback>(
       AsWeakPtr(), std::move(callback));
 
   ledger_->Shutdown(
+      discard_pending_visits,
       std::bind(BatLedgerImpl::OnShutdown,
           holder,
           _1));
@@ -240,7 +240,8 @@ class BatLedgerImpl :
 
   void GetAllPromotions(GetAllPromotionsCallback callback) override;
 
-  void Shutdown(ShutdownCallback callback) override;
+  void Shutdown(bool discard_pending_visits,
+                ShutdownCallback callback) override;
 
   void GetEventLogs(GetEventLogsCallback callback) override;
 